@@ -0,0 +1,38 @@
+#include "args.h"
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace args {
+
+unsigned int toUnsigned(const string& s){
+    size_t pos;
+    if(s.empty() || !isdigit(static_cast<unsigned char>(s[0]))){
+        throw invalid_argument(s);
+    }
+    unsigned long val = stoul(s, &pos);
+    if(pos != s.size() || val > numeric_limits<unsigned int>::max()){
+        throw invalid_argument(s);
+    }
+    return val;
+}
+
+double toRatio(const string& s){
+    size_t pos;
+    double val = stod(s, &pos);
+    if(pos != s.size() || !isfinite(val) || val <= 0){
+        throw invalid_argument(s);
+    }
+    return val;
+}
+
+unsigned int scale(unsigned int n, double ratio){
+    double val = n * ratio + 0.5;
+    if(val > numeric_limits<unsigned int>::max()){
+        throw invalid_argument("ratio too large");
+    }
+    return static_cast<unsigned int>(val);
+}
+
+}
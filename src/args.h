@@ -0,0 +1,23 @@
+#ifndef ARGS_H
+#define ARGS_H
+
+#include <string>
+
+// Strict command line number parsing shared by gen and scaling. Each function throws invalid_argument for
+// input it rejects, so that e.g. "1e6" or "abc" is not silently read as a prefix or as 0
+namespace args {
+
+using namespace std;
+
+// Parses a whole string of decimal digits that fits in an unsigned int
+unsigned int toUnsigned(const string& s);
+
+// Parses a whole string as a finite ratio > 0
+double toRatio(const string& s);
+
+// Returns n * ratio rounded to the nearest integer, e.g. the number of clauses for n variables
+unsigned int scale(unsigned int n, double ratio);
+
+}
+
+#endif
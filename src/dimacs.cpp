@@ -0,0 +1,54 @@
+#include "dimacs.h"
+#include <sstream>
+#include <string>
+
+namespace solver {
+
+int parseDimacs(istream& in, vector<Clause>& f, unsigned int& numVars){
+    // Skip comments
+    string s;
+    while(getline(in, s, '\n')){
+        if(s.size() <= 0){
+            return -2;
+        } else if(s[0] == 'c'){
+            continue;
+        } else {
+            break;
+        }
+    }
+
+    unsigned int numClauses;
+    istringstream sstream(s);
+    string t;
+    if(!(sstream >> t >> t >> numVars >> numClauses)){
+        return -2;
+    }
+
+    // Read in clauses and preprocess
+    for(unsigned int i = 0; i < numClauses; ++i){
+        unordered_set<int> seen;
+        vector<int> lits; // Literals in order of first occurrence
+        int lit;
+        bool isSat = false; // Unknown
+        while(true){
+            if(!(in >> lit)){
+                return -2; // Fewer clauses than declared in header
+            }
+            if(lit == 0){
+                break;
+            } else {
+                if(seen.find(-lit) != seen.end()){ // Both variable and its negation present in same clause - automatically SAT
+                    isSat = true;
+                } else if(seen.insert(lit).second){
+                    lits.push_back(lit);
+                }
+            }
+        }
+        if(!isSat){
+            f.emplace_back(lits);
+        }
+    }
+    return 0;
+}
+
+}
@@ -0,0 +1,17 @@
+#ifndef DIMACS_H
+#define DIMACS_H
+
+#include <istream>
+#include <vector>
+#include "solver.h"
+
+namespace solver {
+
+// Reads a formula in simplified DIMACS format (http://www.satcompetition.org/2009/format-benchmarks2009.html)
+// into f, keeping the order of literals within each clause. Duplicate literals are merged and clauses containing both a variable and its negation are dropped.
+// Returns 0 on success, -2 if the input is incorrectly formatted
+int parseDimacs(istream& in, vector<Clause>& f, unsigned int& numVars);
+
+}
+
+#endif
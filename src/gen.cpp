@@ -0,0 +1,61 @@
+#include <exception>
+#include <iostream>
+#include <string>
+#include "args.h"
+#include "generator.h"
+
+using namespace std;
+
+void usage(){
+    cerr << "Usage: ./gen ksat vars [ratio] [k] [seed]" << endl;
+    cerr << "       ./gen pigeonhole holes" << endl;
+    cerr << "       ./gen parity n [seed]" << endl;
+    cerr << "       ./gen coloring vertices edges [colors] [seed]" << endl;
+}
+
+// Writes a generated formula in DIMACS format to stdout. The same arguments always give the same formula,
+// whichever standard library gen was built with
+int main(int argc, char** argv){
+    if(argc < 3){
+        usage();
+        return -1;
+    }
+
+    string family = argv[1];
+    generator::Cnf cnf(0);
+    try {
+        if(family == "ksat"){
+            unsigned int numVars = args::toUnsigned(argv[2]);
+            double ratio = argc > 3 ? args::toRatio(argv[3]) : 4.26;
+            unsigned int k = argc > 4 ? args::toUnsigned(argv[4]) : 3;
+            unsigned int seed = argc > 5 ? args::toUnsigned(argv[5]) : 0;
+            cnf = generator::randomKSat(numVars, args::scale(numVars, ratio), k, seed);
+        } else if(family == "pigeonhole"){
+            cnf = generator::pigeonhole(args::toUnsigned(argv[2]));
+        } else if(family == "parity"){
+            unsigned int seed = argc > 3 ? args::toUnsigned(argv[3]) : 0;
+            cnf = generator::parity(args::toUnsigned(argv[2]), seed);
+        } else if(family == "coloring" && argc > 3){
+            unsigned int colors = argc > 4 ? args::toUnsigned(argv[4]) : 3;
+            unsigned int seed = argc > 5 ? args::toUnsigned(argv[5]) : 0;
+            cnf = generator::coloring(args::toUnsigned(argv[2]), args::toUnsigned(argv[3]), colors, seed);
+        } else {
+            usage();
+            return -1;
+        }
+    } catch(const char* e){
+        cerr << e << endl;
+        return -2;
+    } catch(const exception& e){ // Malformed or out of range number
+        usage();
+        return -1;
+    }
+
+    cout << "c Generated by:";
+    for(int i = 0; i < argc; ++i){
+        cout << " " << argv[i];
+    }
+    cout << "\n";
+    generator::writeDimacs(cout, cnf);
+    return 0;
+}
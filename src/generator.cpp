@@ -0,0 +1,190 @@
+#include "generator.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <unordered_set>
+
+namespace generator {
+
+void addXor(Cnf& cnf, int a, int b, int c, bool rhs);
+
+unsigned int randomBelow(mt19937& rng, unsigned int n){
+    return static_cast<uint32_t>(rng()) % n;
+}
+
+bool randomBool(mt19937& rng){
+    return rng() & 1;
+}
+
+void randomShuffle(vector<unsigned int>& v, mt19937& rng){
+    for(size_t i = v.size(); i > 1; --i){
+        swap(v[i - 1], v[randomBelow(rng, i)]);
+    }
+}
+
+Cnf::Cnf(unsigned int numVars) : numVars(numVars){}
+
+Cnf randomKSat(unsigned int numVars, unsigned int numClauses, unsigned int k, unsigned int seed){
+    if(k == 0 || k > numVars){
+        throw "k must be between 1 and the number of variables";
+    }
+    Cnf cnf(numVars);
+    cnf.clauses.reserve(numClauses);
+    mt19937 rng(seed);
+    for(unsigned int i = 0; i < numClauses; ++i){
+        unordered_set<int> vars;
+        vector<int> lits;
+        while(lits.size() < k){
+            int var = randomBelow(rng, numVars) + 1;
+            if(vars.insert(var).second){
+                lits.push_back(randomBool(rng) ? var : -var);
+            }
+        }
+        cnf.clauses.push_back(lits);
+    }
+    return cnf;
+}
+
+Cnf pigeonhole(unsigned int holes){
+    if(holes == 0){
+        throw "pigeonhole needs at least one hole";
+    }
+    unsigned int pigeons = holes + 1;
+    // Variable for pigeon p being in hole h, with p in [0, pigeons) and h in [0, holes)
+    auto var = [holes](unsigned int p, unsigned int h){ return static_cast<int>(p * holes + h + 1); };
+    Cnf cnf(pigeons * holes);
+
+    // Every pigeon is in some hole
+    for(unsigned int p = 0; p < pigeons; ++p){
+        vector<int> lits;
+        for(unsigned int h = 0; h < holes; ++h){
+            lits.push_back(var(p, h));
+        }
+        cnf.clauses.push_back(lits);
+    }
+    // No two pigeons share a hole
+    for(unsigned int h = 0; h < holes; ++h){
+        for(unsigned int p1 = 0; p1 < pigeons; ++p1){
+            for(unsigned int p2 = p1 + 1; p2 < pigeons; ++p2){
+                cnf.clauses.push_back(vector<int>{-var(p1, h), -var(p2, h)});
+            }
+        }
+    }
+    return cnf;
+}
+
+// Adds clauses constraining a xor b xor c to equal rhs, i.e. ruling out each assignment of the wrong parity
+void addXor(Cnf& cnf, int a, int b, int c, bool rhs){
+    for(int mask = 0; mask < 8; ++mask){
+        bool va = mask & 1;
+        bool vb = mask & 2;
+        bool vc = mask & 4;
+        if(((va != vb) != vc) != rhs){
+            cnf.clauses.push_back(vector<int>{va ? -a : a, vb ? -b : b, vc ? -c : c});
+        }
+    }
+}
+
+Cnf parity(unsigned int n, unsigned int seed){
+    if(n == 0){
+        throw "parity chain needs at least one link";
+    }
+    // Chain variables 1..2n form a ring, with constraint i linking chain variables i+1 and i+2 (mod 2n).
+    // As in the dubois benchmarks, the ring is folded in half: constraints i and 2n-1-i share an extra variable
+    unsigned int numConstraints = 2 * n;
+    Cnf cnf(3 * n);
+    mt19937 rng(seed);
+    bool total = false;
+    for(unsigned int i = 0; i < numConstraints; ++i){
+        int chain1 = i + 1;
+        int chain2 = (i + 1) % numConstraints + 1;
+        int extra = numConstraints + min(i, numConstraints - 1 - i) + 1;
+        // Last parity is fixed so that the parities sum to 1, while every variable is counted twice
+        bool rhs = (i + 1 < numConstraints) ? randomBool(rng) : !total;
+        total = total != rhs;
+        addXor(cnf, chain1, chain2, extra, rhs);
+    }
+    return cnf;
+}
+
+Cnf coloring(unsigned int vertices, unsigned int edges, unsigned int colors, unsigned int seed){
+    if(colors < 2 || vertices < colors){
+        throw "coloring needs at least two colors and as many vertices as colors";
+    }
+    mt19937 rng(seed);
+
+    // Planted coloring: vertices are split evenly into color classes, and edges only join different classes
+    vector<unsigned int> planted(vertices);
+    for(unsigned int v = 0; v < vertices; ++v){
+        planted[v] = v % colors;
+    }
+    randomShuffle(planted, rng);
+
+    // All vertex pairs, minus those within a color class
+    unsigned long long maxEdges = static_cast<unsigned long long>(vertices) * (vertices - 1) / 2;
+    for(unsigned int c = 0; c < colors; ++c){
+        unsigned long long classSize = vertices / colors + (c < vertices % colors);
+        maxEdges -= classSize * (classSize - 1) / 2;
+    }
+    if(edges > maxEdges){
+        throw "too many edges for a graph with a planted coloring";
+    }
+
+    set<pair<unsigned int, unsigned int>> edgeSet;
+    while(edgeSet.size() < edges){
+        unsigned int u = randomBelow(rng, vertices);
+        unsigned int v = randomBelow(rng, vertices);
+        if(planted[u] != planted[v]){
+            edgeSet.insert(make_pair(min(u, v), max(u, v)));
+        }
+    }
+
+    // Variable for vertex v having color c
+    auto var = [colors](unsigned int v, unsigned int c){ return static_cast<int>(v * colors + c + 1); };
+    Cnf cnf(vertices * colors);
+    // Every vertex has at least one color
+    for(unsigned int v = 0; v < vertices; ++v){
+        vector<int> lits;
+        for(unsigned int c = 0; c < colors; ++c){
+            lits.push_back(var(v, c));
+        }
+        cnf.clauses.push_back(lits);
+    }
+    // Every vertex has at most one color
+    for(unsigned int v = 0; v < vertices; ++v){
+        for(unsigned int c1 = 0; c1 < colors; ++c1){
+            for(unsigned int c2 = c1 + 1; c2 < colors; ++c2){
+                cnf.clauses.push_back(vector<int>{-var(v, c1), -var(v, c2)});
+            }
+        }
+    }
+    // Adjacent vertices have different colors
+    for(const pair<unsigned int, unsigned int>& e : edgeSet){
+        for(unsigned int c = 0; c < colors; ++c){
+            cnf.clauses.push_back(vector<int>{-var(e.first, c), -var(e.second, c)});
+        }
+    }
+    return cnf;
+}
+
+void writeDimacs(ostream& os, const Cnf& cnf){
+    os << "p cnf " << cnf.numVars << " " << cnf.clauses.size() << "\n";
+    for(const vector<int>& lits : cnf.clauses){
+        for(int lit : lits){
+            os << lit << " ";
+        }
+        os << "0\n";
+    }
+}
+
+vector<solver::Clause> toClauses(const Cnf& cnf){
+    vector<solver::Clause> f;
+    f.reserve(cnf.clauses.size());
+    for(const vector<int>& lits : cnf.clauses){
+        f.emplace_back(lits);
+    }
+    return f;
+}
+
+}
@@ -0,0 +1,55 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include "solver.h"
+
+namespace generator {
+
+using namespace std;
+
+// Formula in conjunctive normal form. Literals follow the DIMACS convention: variables are numbered from 1,
+// and a negative literal indicates negation of the variable
+class Cnf {
+    public:
+        Cnf(unsigned int numVars);
+        unsigned int numVars;
+        vector<vector<int>> clauses;
+};
+
+// The standard distributions and std::shuffle are implementation defined, so random choices are made directly
+// from the mt19937 output with these. That way a seed gives the same result with any standard library
+
+// Returns a number in [0, n)
+unsigned int randomBelow(mt19937& rng, unsigned int n);
+
+bool randomBool(mt19937& rng);
+
+// Fisher-Yates shuffle
+void randomShuffle(vector<unsigned int>& v, mt19937& rng);
+
+// Uniform random k-SAT: each clause has k distinct variables, each negated with probability 1/2
+Cnf randomKSat(unsigned int numVars, unsigned int numClauses, unsigned int k, unsigned int seed);
+
+// Pigeonhole principle with holes + 1 pigeons and the given number of holes. Always unsatisfiable
+Cnf pigeonhole(unsigned int holes);
+
+// Dubois-like parity chain on 3n variables: a folded ring of 2n three-variable XOR constraints in which every
+// variable occurs twice and the constraint parities sum to 1. Always unsatisfiable
+Cnf parity(unsigned int n, unsigned int seed);
+
+// Graph coloring in the style of the flat* benchmarks: a random graph on the given number of vertices and edges
+// with a planted coloring, encoded with one variable per (vertex, color) pair. Always satisfiable
+Cnf coloring(unsigned int vertices, unsigned int edges, unsigned int colors, unsigned int seed);
+
+// Writes cnf to os in DIMACS format
+void writeDimacs(ostream& os, const Cnf& cnf);
+
+// Converts cnf to the Clause representation consumed by the solver
+vector<solver::Clause> toClauses(const Cnf& cnf);
+
+}
+
+#endif
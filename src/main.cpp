@@ -1,7 +1,6 @@
 #include <iostream>
 #include <fstream>
-#include <sstream>
-#include <string>
+#include "dimacs.h"
 #include "solver.h"
 
 using namespace std;
@@ -21,47 +20,11 @@ int main(int argc, char** argv){
         return -1;
     }
 
-    // Skip comments
-    string s;
-    while(getline(inFile, s, '\n')){
-        if(s.size() <= 0){
-            cerr << "Incorrect file format" << endl;
-            return -2;
-        } else if(s[0] == 'c'){
-            continue;
-        } else {
-            break;
-        }
-    }
-
-    unsigned int numVars;
-    unsigned int numClauses;
-    istringstream sstream(s);
-    string t;
-    sstream >> t >> t >> numVars >> numClauses;
-
-    // Read in clauses and preprocess
     vector<solver::Clause> f;
-    for(unsigned int i = 0; i < numClauses; ++i){
-        unordered_set<int> seen;
-        int lit;
-        bool isSat = false; // Unknown
-        while(true){
-            inFile >> lit;
-            if(lit == 0){
-                break;
-            } else {
-                if(seen.find(-lit) != seen.end()){ // Both variable and its negation present in same clause - automatically SAT
-                    isSat = true;
-                } else {
-                    seen.insert(lit);
-                }
-            }
-        }
-        if(!isSat){
-            vector<int> lits(seen.begin(), seen.end());
-            f.emplace_back(lits);
-        }
+    unsigned int numVars;
+    if(solver::parseDimacs(inFile, f, numVars) < 0){
+        cerr << "Incorrect file format" << endl;
+        return -2;
     }
     inFile.close();
 
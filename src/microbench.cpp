@@ -0,0 +1,249 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include "dimacs.h"
+#include "generator.h"
+#include "solver.h"
+
+// Micro-benchmarks for the individual solver kernels. Inputs are generated with fixed seeds, or read from the
+// benchmark CNFs (paths are relative to the repository root), so that results are comparable between runs.
+
+using namespace std;
+
+namespace {
+
+const unsigned int seed = 42;
+const double satThreshold = 4.26; // Clause to variable ratio at which random 3-SAT is hardest
+
+// Solver state after propagating a fixed sequence of decisions
+class Trail {
+    public:
+        Trail(const generator::Cnf& cnf);
+        vector<solver::Clause> f;
+        vector<solver::VarAssignment> a;
+        map<int, unordered_set<unsigned int>> watchLists;
+        int level;
+        unsigned int numAssigned;
+};
+
+Trail::Trail(const generator::Cnf& cnf) : f(generator::toClauses(cnf)), a(cnf.numVars + 1),
+    watchLists(solver::initWatchLists(f)), level(0), numAssigned(0){}
+
+// VarAssignment::setAssignment is inline within the solver, so assignments are made directly here
+void assign(solver::VarAssignment& v, bool truthVal, int level, unsigned int step){
+    v.truthVal = truthVal;
+    v.level = level;
+    v.step = step;
+    v.antecedent = 0;
+}
+
+// Seeded random order of decision literals, one per variable. Uses the generator's random helpers, so the
+// trail is the same with any standard library
+vector<int> decisionOrder(unsigned int numVars){
+    vector<unsigned int> vars;
+    for(unsigned int var = 1; var <= numVars; ++var){
+        vars.push_back(var);
+    }
+    mt19937 rng(seed);
+    generator::randomShuffle(vars, rng);
+    vector<int> lits;
+    for(unsigned int var : vars){
+        lits.push_back(generator::randomBool(rng) ? static_cast<int>(var) : -static_cast<int>(var));
+    }
+    return lits;
+}
+
+// Decides each unassigned literal in turn on a new level and propagates it, stopping at the first conflict.
+// Returns the conflicting clause number and true if a conflict was found. Adds the decisions made to numDecisions
+pair<unsigned int, bool> propagateTrail(Trail& t, const vector<int>& decisions, unsigned int& numDecisions){
+    for(int lit : decisions){
+        int var = abs(lit);
+        if(t.a[var].level >= 0){
+            continue;
+        }
+        ++numDecisions;
+        ++t.level;
+        int step = 0;
+        assign(t.a[var], lit > 0, t.level, step++);
+        ++t.numAssigned;
+        tuple<int, unsigned int, int> conflict = solver::bcp(t.f, t.a, queue<int>(deque<int>{lit}), t.watchLists,
+                                                             t.level, step, t.numAssigned);
+        if(get<0>(conflict) < 0){
+            return make_pair(get<1>(conflict), true);
+        }
+    }
+    return make_pair(0, false);
+}
+
+generator::Cnf random3Sat(unsigned int numVars, double ratio){
+    return generator::randomKSat(numVars, static_cast<unsigned int>(numVars * ratio), 3, seed);
+}
+
+void BM_ParseDimacsFile(benchmark::State& state, const string& path){
+    ifstream inFile(path);
+    if(!inFile){
+        state.SkipWithError(("Unable to open " + path).c_str());
+        return;
+    }
+    stringstream contents;
+    contents << inFile.rdbuf();
+    const string s = contents.str();
+
+    for(auto _ : state){
+        istringstream in(s);
+        vector<solver::Clause> f;
+        unsigned int numVars;
+        int res = solver::parseDimacs(in, f, numVars);
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(f.data());
+    }
+    state.SetBytesProcessed(state.iterations() * s.size());
+}
+BENCHMARK_CAPTURE(BM_ParseDimacsFile, uf100, string("benchmarks/benchmarks/uf100-430/uf100-01.cnf"));
+BENCHMARK_CAPTURE(BM_ParseDimacsFile, flat150, string("benchmarks/benchmarks/Flat150-360/flat150-1.cnf"));
+BENCHMARK_CAPTURE(BM_ParseDimacsFile, bench2, string("benchmarks/benchmarks/bench2/unsat/180-2200.cnf"));
+BENCHMARK_CAPTURE(BM_ParseDimacsFile, hanoi5, string("benchmarks/benchmarks/hanoi/hanoi5.cnf"));
+
+void BM_ParseDimacsRandom3Sat(benchmark::State& state){
+    ostringstream out;
+    generator::writeDimacs(out, random3Sat(state.range(0), satThreshold));
+    const string s = out.str();
+
+    for(auto _ : state){
+        istringstream in(s);
+        vector<solver::Clause> f;
+        unsigned int numVars;
+        int res = solver::parseDimacs(in, f, numVars);
+        benchmark::DoNotOptimize(res);
+        benchmark::DoNotOptimize(f.data());
+    }
+    state.SetBytesProcessed(state.iterations() * s.size());
+}
+BENCHMARK(BM_ParseDimacsRandom3Sat)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+void BM_InitWatchLists(benchmark::State& state){
+    vector<solver::Clause> f = generator::toClauses(random3Sat(state.range(0), satThreshold));
+    for(auto _ : state){
+        map<int, unordered_set<unsigned int>> watchLists = solver::initWatchLists(f);
+        benchmark::DoNotOptimize(watchLists);
+    }
+    state.SetItemsProcessed(state.iterations() * f.size());
+}
+BENCHMARK(BM_InitWatchLists)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+// Propagation throughput along a fixed trail. Items are variable assignments made by bcp, excluding decisions
+void runBcp(benchmark::State& state, const generator::Cnf& cnf){
+    const Trail initial(cnf);
+    const vector<int> decisions = decisionOrder(cnf.numVars);
+    unsigned long propagated = 0;
+    for(auto _ : state){
+        state.PauseTiming();
+        Trail t = initial;
+        state.ResumeTiming();
+        unsigned int numDecisions = 0;
+        pair<unsigned int, bool> conflict = propagateTrail(t, decisions, numDecisions);
+        benchmark::DoNotOptimize(conflict);
+        propagated += t.numAssigned - numDecisions;
+    }
+    state.SetItemsProcessed(propagated);
+}
+
+void BM_BcpRandom3Sat(benchmark::State& state){
+    // Below the threshold, so that the trail gets long before the first conflict
+    runBcp(state, random3Sat(state.range(0), 3.0));
+}
+BENCHMARK(BM_BcpRandom3Sat)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+void BM_BcpPigeonhole(benchmark::State& state){
+    runBcp(state, generator::pigeonhole(state.range(0)));
+}
+BENCHMARK(BM_BcpPigeonhole)->DenseRange(6, 12, 2)->Unit(benchmark::kMicrosecond);
+
+// analyzeConflict does not modify the formula or assignment, so the same conflict is analyzed every iteration
+void runAnalyzeConflict(benchmark::State& state, const generator::Cnf& cnf){
+    Trail t(cnf);
+    unsigned int numDecisions = 0;
+    pair<unsigned int, bool> conflict = propagateTrail(t, decisionOrder(cnf.numVars), numDecisions);
+    if(!conflict.second){
+        state.SkipWithError("Trail did not reach a conflict");
+        return;
+    }
+    for(auto _ : state){
+        pair<int, solver::Clause> learnt = solver::analyzeConflict(t.f, t.a, conflict.first);
+        benchmark::DoNotOptimize(learnt.first);
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_AnalyzeConflictRandom3Sat(benchmark::State& state){
+    runAnalyzeConflict(state, random3Sat(state.range(0), satThreshold));
+}
+BENCHMARK(BM_AnalyzeConflictRandom3Sat)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+void BM_AnalyzeConflictPigeonhole(benchmark::State& state){
+    runAnalyzeConflict(state, generator::pigeonhole(state.range(0)));
+}
+BENCHMARK(BM_AnalyzeConflictPigeonhole)->DenseRange(6, 12, 2)->Unit(benchmark::kMicrosecond);
+
+// Bumps scores for the literals of every clause once, as is done for each learnt clause. Each pass starts from
+// fresh scores, since updates change the ties that later updates have to walk through. Items are updates
+void BM_VsidsUpdate(benchmark::State& state){
+    vector<solver::Clause> f = generator::toClauses(random3Sat(state.range(0), satThreshold));
+    for(auto _ : state){
+        state.PauseTiming();
+        solver::Vsids vsids(f);
+        state.ResumeTiming();
+        for(solver::Clause& c : f){
+            vsids.update(c);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * f.size());
+}
+BENCHMARK(BM_VsidsUpdate)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+
+// Decides every variable in turn until the assignment is complete. Items are decisions
+void BM_VsidsDecide(benchmark::State& state){
+    const unsigned int numVars = state.range(0);
+    vector<solver::Clause> f = generator::toClauses(random3Sat(numVars, satThreshold));
+    for(auto _ : state){
+        state.PauseTiming();
+        solver::Vsids vsids(f);
+        vector<solver::VarAssignment> a(numVars + 1);
+        state.ResumeTiming();
+        int lit;
+        while((lit = vsids.decide(a)) != 0){
+            a[abs(lit)].level = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numVars);
+}
+BENCHMARK(BM_VsidsDecide)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+// Backtracks from a full assignment spread over 10 levels to level 5. Items are variables scanned
+void BM_Backtrack(benchmark::State& state){
+    const unsigned int numVars = state.range(0);
+    const int numLevels = 10;
+    vector<solver::Clause> f = generator::toClauses(random3Sat(numVars, satThreshold));
+    solver::Vsids vsids(f);
+    vector<solver::VarAssignment> full(numVars + 1);
+    for(unsigned int var = 1; var <= numVars; ++var){
+        assign(full[var], true, var % numLevels + 1, var / numLevels);
+    }
+    for(auto _ : state){
+        state.PauseTiming();
+        vector<solver::VarAssignment> a = full;
+        unsigned int numAssigned = numVars;
+        state.ResumeTiming();
+        unsigned int maxStep = solver::backtrack(a, vsids, numLevels / 2, numAssigned);
+        benchmark::DoNotOptimize(maxStep);
+    }
+    state.SetItemsProcessed(state.iterations() * numVars);
+}
+BENCHMARK(BM_Backtrack)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond);
+
+}
+
+BENCHMARK_MAIN();
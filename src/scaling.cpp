@@ -0,0 +1,176 @@
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "args.h"
+#include "generator.h"
+#include "solver.h"
+
+using namespace std;
+
+void usage(){
+    cerr << "Usage: ./scaling [-t timeout] [-s seed] [-r ratio] family size..." << endl;
+    cerr << "  family: ksat (size = vars, ratio = clauses per var, default 3.0)" << endl;
+    cerr << "          pigeonhole (size = holes)" << endl;
+    cerr << "          parity (size = n, 3n vars)" << endl;
+    cerr << "          coloring (size = vertices, ratio = edges per vertex, default 2.4, 3 colors)" << endl;
+}
+
+// Default ratio for each family that takes one. For ksat it is below the 4.26 threshold, so that large sizes are
+// solvable and the study measures how the data structures scale rather than search hardness
+double defaultRatio(const string& family){
+    return family == "ksat" ? 3.0 : 2.4;
+}
+
+generator::Cnf makeInstance(const string& family, unsigned int size, double ratio, unsigned int seed){
+    if(family == "ksat"){
+        return generator::randomKSat(size, args::scale(size, ratio), 3, seed);
+    } else if(family == "pigeonhole"){
+        return generator::pigeonhole(size);
+    } else if(family == "parity"){
+        return generator::parity(size, seed);
+    } else {
+        return generator::coloring(size, args::scale(size, ratio), 3, seed);
+    }
+}
+
+// Generates and solves one instance, writing "vars clauses result seconds decisions conflicts propagations"
+// to fd. Runs in a child process so that its peak RSS can be measured on its own. The timeout only covers CDCL
+void solveInstance(int fd, const string& family, unsigned int size, double ratio, unsigned int seed,
+                   unsigned int timeout){
+    vector<solver::Clause> f;
+    unsigned int numVars;
+    {
+        generator::Cnf cnf = makeInstance(family, size, ratio, seed);
+        f = generator::toClauses(cnf);
+        numVars = cnf.numVars;
+    }
+    size_t numClauses = f.size();
+
+    solver::Stats stats;
+    if(timeout > 0){
+        alarm(timeout);
+    }
+    auto start = chrono::steady_clock::now();
+    pair<int, vector<int>> res = solver::CDCL(f, numVars, stats);
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    ostringstream out;
+    out << numVars << " " << numClauses << " " << (res.first == 1 ? "sat" : "unsat") << " " << elapsed.count()
+        << " " << stats.decisions << " " << stats.conflicts << " " << stats.propagations << "\n";
+    string s = out.str();
+    if(write(fd, s.data(), s.size()) < 0){
+        _exit(2);
+    }
+}
+
+// Runs the solver on instances of increasing size from one family, and prints a tab separated table of solve
+// time, peak RSS (of generation and solving together) and propagation rate. Each instance is solved in a fresh process. A size that times out or
+// fails ends the study, since larger sizes of the same family are not expected to do better
+int main(int argc, char** argv){
+    unsigned int timeout = 0; // Seconds, 0 for none
+    unsigned int seed = 0;
+    double ratio = 0; // 0 until set by -r, then replaced by the family default
+    vector<unsigned int> sizes;
+    string family;
+    try {
+        int opt;
+        while((opt = getopt(argc, argv, "t:s:r:")) != -1){
+            switch(opt){
+                case 't': timeout = args::toUnsigned(optarg); break;
+                case 's': seed = args::toUnsigned(optarg); break;
+                case 'r': ratio = args::toRatio(optarg); break;
+                default: usage(); return -1;
+            }
+        }
+        if(argc - optind < 2){
+            usage();
+            return -1;
+        }
+        family = argv[optind];
+        for(int i = optind + 1; i < argc; ++i){
+            sizes.push_back(args::toUnsigned(argv[i]));
+        }
+    } catch(const exception& e){ // Malformed number
+        usage();
+        return -1;
+    }
+    if(family != "ksat" && family != "pigeonhole" && family != "parity" && family != "coloring"){
+        usage();
+        return -1;
+    }
+    if(ratio == 0){
+        ratio = defaultRatio(family);
+    }
+
+    cout << "family\tsize\tvars\tclauses\tresult\tseconds\tpeak_rss_kb\tdecisions\tconflicts\tpropagations\t"
+         << "props_per_sec" << endl;
+    for(unsigned int size : sizes){
+        int fds[2];
+        if(pipe(fds) < 0){
+            perror("pipe");
+            return -2;
+        }
+        pid_t pid = fork();
+        if(pid < 0){
+            perror("fork");
+            return -2;
+        } else if(pid == 0){
+            close(fds[0]);
+            try {
+                solveInstance(fds[1], family, size, ratio, seed, timeout);
+            } catch(const char* e){
+                cerr << e << endl;
+                _exit(1);
+            } catch(const exception& e){
+                cerr << e.what() << endl;
+                _exit(1);
+            }
+            _exit(0);
+        }
+
+        close(fds[1]);
+        string line;
+        char buf[256];
+        ssize_t n;
+        while((n = read(fds[0], buf, sizeof(buf))) > 0){
+            line.append(buf, n);
+        }
+        close(fds[0]);
+
+        int status;
+        struct rusage ru;
+        wait4(pid, &status, 0, &ru);
+        // Peak over the whole child, so it includes generating the instance as well as solving it
+#ifdef __APPLE__
+        long peakRss = ru.ru_maxrss / 1024; // Reported in bytes
+#else
+        long peakRss = ru.ru_maxrss; // Reported in kilobytes
+#endif
+
+        if(WIFSIGNALED(status) || WEXITSTATUS(status) != 0 || line.empty()){
+            string result = (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM) ? "timeout" : "failed";
+            cout << family << "\t" << size << "\t-\t-\t" << result << "\t-\t" << peakRss << "\t-\t-\t-\t-" << endl;
+            break;
+        }
+
+        istringstream in(line);
+        unsigned int numVars;
+        size_t numClauses;
+        string result;
+        double seconds;
+        unsigned long decisions, conflicts, propagations;
+        in >> numVars >> numClauses >> result >> seconds >> decisions >> conflicts >> propagations;
+        cout << family << "\t" << size << "\t" << numVars << "\t" << numClauses << "\t" << result << "\t" << seconds
+             << "\t" << peakRss << "\t" << decisions << "\t" << conflicts << "\t" << propagations << "\t"
+             << static_cast<unsigned long>(seconds > 0 ? propagations / seconds : 0) << endl;
+    }
+    return 0;
+}
@@ -54,6 +54,8 @@ inline unsigned int Clause::size(){
     return this->lits.size();
 }
 
+Stats::Stats() : decisions(0), propagations(0), conflicts(0){}
+
 Decider::Decider(vector<Clause>& f) : counter(0) {}
 
 Decider::~Decider(){}
@@ -148,6 +150,11 @@ void Vsids::addToContention(int var){
 }
 
 pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars){
+    Stats stats;
+    return CDCL(f, numVars, stats);
+}
+
+pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars, Stats& stats){
     vector<VarAssignment> assignment(numVars + 1);
     unsigned int numAssigned = 0; // Number of variables that solver has assigned
     int level = 0;
@@ -159,6 +166,7 @@ pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars){
     if(initialCheck(f, assignment, watchLists, level, numAssigned) < 0){ // See if initial check yields conflict
         return make_pair(0, vector<int>());
     }
+    stats.propagations += numAssigned;
 
     while(numAssigned < numVars){
         ++level;
@@ -166,11 +174,15 @@ pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars){
         int guessedLit = vsids.decide(assignment);
         bool truthVal = guessedLit > 0 ? true : false;
         setAssignment(assignment, abs(guessedLit), truthVal, level, step, 0, numAssigned);
+        ++stats.decisions;
+        unsigned int prevAssigned = numAssigned;
 
         queue<int> q(deque<int>{guessedLit});
         tuple<int, unsigned int, int> conflict; // (isConflict, clause number, conflicting variable) tuple
 
         while(get<0>(conflict = bcp(f, assignment, q, watchLists, level, step, numAssigned)) < 0){
+            stats.propagations += numAssigned - prevAssigned;
+            ++stats.conflicts;
             vsids.stepCounter();
             pair<int, Clause> newClause = analyzeConflict(f, assignment, get<1>(conflict));
             if(newClause.first < 0){
@@ -183,6 +195,7 @@ pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars){
             int maxStep = backtrack(assignment, vsids, newClause.first, numAssigned);
             step = maxStep + 1;
             level = newClause.first;
+            prevAssigned = numAssigned; // Assignment implied by the new clause counts as a propagation
             int newClauseNum = f.size();
 
             const vector<int>& lits = newClause.second.getLits();
@@ -227,6 +240,7 @@ pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars){
             addToWatchLists(watchLists, newClause.second, f.size()-1);
             vsids.update(newClause.second);
         }
+        stats.propagations += numAssigned - prevAssigned;
     }
 
     // Since all variables are assigned, formula is satisfiable
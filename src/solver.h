@@ -41,6 +41,15 @@ class Clause {
         const vector<int> lits;
 };
 
+// Search counters collected by CDCL
+class Stats {
+    public:
+        Stats();
+        unsigned long decisions;
+        unsigned long propagations; // Assignments made by unit propagation, including those from learnt clauses
+        unsigned long conflicts;
+};
+
 // Abstract base class for decision heuristic that guesses a new variable to propagate on
 class Decider {
     public:
@@ -98,6 +107,9 @@ unsigned int backtrack(vector<VarAssignment>& a, Vsids& vsids, const int newLeve
 // Returns 1 and a satisfying assignment if formula f is satisfiable, 0 or a negative number otherwise
 pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars);
 
+// As above, also recording search counters in stats
+pair<int, vector<int>> CDCL(vector<Clause>& f, const unsigned int numVars, Stats& stats);
+
 }
 
 #endif